@@ -93,6 +93,10 @@ n2d_buffer_t;
 
 typedef struct _gcoTLS* gcoTLS;
 
+typedef n2d_uintptr_t n2d_cmdlist_t;
+
+#define N2D_CMDLIST_SLOT_MAX 16
+
 n2d_error_t n2d_open(
     n2d_void);
 
@@ -130,6 +134,61 @@ n2d_error_t n2d_commit(
 n2d_error_t n2d_commit_ex(
     n2d_bool_t stall);
 
+/*
+ * n2d_commit_async submits the current command buffer without stall. The GPU
+ * waits for the in_fence sync_file fds before executing, the returned
+ * out_fence sync_file fd is signaled when the commands are done and is
+ * closed by the caller. in_fence could be N2D_NULL with in_fence_num 0.
+ * n2d_wait_fence waits on the CPU for a sync_file fd, timeout is in ms,
+ * <0 waits forever and 0 only checks; it returns N2D_TIMEOUT if the fence
+ * is not signaled in time.
+ */
+n2d_error_t n2d_commit_async(
+    const n2d_int32_t *in_fence,
+    n2d_uint32_t in_fence_num,
+    n2d_int32_t *out_fence);
+
+n2d_error_t n2d_wait_fence(
+    n2d_int32_t fence,
+    n2d_int32_t timeout);
+
+/*
+ * Command list recording. Between n2d_cmdlist_begin and n2d_cmdlist_end the
+ * n2d_set/n2d_fill/n2d_blit/n2d_filterblit/n2d_multisource_blit calls are
+ * recorded into the list instead of the current command buffer.
+ * n2d_cmdlist_set_slot marks a buffer used by the recorded calls as patchable;
+ * before each n2d_cmdlist_submit, n2d_cmdlist_bind rebinds the slot to another
+ * buffer of the same width, height, stride, format and tiling, and only the
+ * buffer addresses are patched. The list is submitted like n2d_commit_ex.
+ */
+n2d_error_t n2d_cmdlist_begin(
+    n2d_void);
+
+n2d_error_t n2d_cmdlist_end(
+    n2d_cmdlist_t *list);
+
+n2d_error_t n2d_cmdlist_set_slot(
+    n2d_buffer_t *buffer,
+    n2d_uint32_t slot);
+
+n2d_error_t n2d_cmdlist_bind(
+    n2d_cmdlist_t list,
+    n2d_uint32_t slot,
+    n2d_buffer_t *buffer);
+
+n2d_error_t n2d_cmdlist_submit(
+    n2d_cmdlist_t list,
+    n2d_bool_t stall);
+
+n2d_error_t n2d_cmdlist_submit_async(
+    n2d_cmdlist_t list,
+    const n2d_int32_t *in_fence,
+    n2d_uint32_t in_fence_num,
+    n2d_int32_t *out_fence);
+
+n2d_error_t n2d_cmdlist_free(
+    n2d_cmdlist_t list);
+
 n2d_error_t n2d_set(
     n2d_state_config_t *config);
 
@@ -201,6 +201,14 @@ typedef struct n2d_filter_user_defined_config
 }
 n2d_filter_user_defined_config_t;
 
+typedef struct n2d_overflow_device_config
+{
+    n2d_bool_t                   enable;
+    n2d_device_id_t              device;
+    n2d_uint32_t                 pendingThreshold;
+}
+n2d_overflow_device_config_t;
+
 typedef struct n2d_state_config
 {
     n2d_state_type_t      state;
@@ -240,6 +248,7 @@ typedef struct n2d_state_config
         n2d_filter_type_t                   filterType;
         n2d_u8_to_u10_conversion_mode_t     u8Tou10cvtMode;
         n2d_filter_user_defined_config_t    filterUserDefined;
+        n2d_overflow_device_config_t        overflowDevice;
     } config;
 }
 n2d_state_config_t;
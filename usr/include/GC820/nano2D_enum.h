@@ -370,6 +370,15 @@ typedef enum n2d_device_id
     N2D_DEVICE_5,
     N2D_DEVICE_6,
     N2D_DEVICE_7,
+
+    /* CPU reference device, NEON/SSE vectorized. Supports linear NV12,
+       RGBA8888 and A8 buffers, BT601/BT709/BT2020 CSC, blit, filterblit,
+       multisource blit and histogram.
+       The id is outside NANO2D_DEVICE_MAX on purpose and is never an index
+       of the per device/core tables: n2d_switch_device and the overflow
+       device check it before the range check, N2D_GET_DEVICE_COUNT does not
+       count it, and it has a single core, N2D_CORE_0. */
+    N2D_DEVICE_CPU = 0x100,
 } n2d_device_id_t;
 
 typedef enum n2d_core_id
@@ -446,6 +455,7 @@ typedef enum n2d_state_type
     N2D_SET_FILTER_TYPE,
     N2D_SET_U8TOU10CVT_MODE,
     N2D_SET_FILTER_USER_DEFINED,
+    N2D_SET_OVERFLOW_DEVICE,
 }
 n2d_state_type_t;
 
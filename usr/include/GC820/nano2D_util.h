@@ -96,6 +96,29 @@ BMPINFO;
 
 #pragma pack()
 
+#define N2D_COMPOSE_SOURCE_MAX 8     /* sources merged by one n2d_multisource_blit */
+
+typedef struct n2d_compose_layer
+{
+    n2d_buffer_t        *source;
+    n2d_rectangle_t     srcRect;
+    n2d_rectangle_t     dstRect;
+    n2d_blend_t         blend;
+    n2d_int32_t         zorder;      /* higher is on top */
+    n2d_bool_t          opaque;      /* no transparent pixel, see n2d_util_compose for clipping */
+}
+n2d_compose_layer_t;
+
+typedef struct n2d_compose_report
+{
+    n2d_uint32_t        passCount;       /* n2d_multisource_blit passes */
+    n2d_uint32_t        filterblitCount; /* scaled layers drawn by n2d_filterblit */
+    n2d_uint32_t        clippedCount;    /* layers fully occluded */
+    n2d_uint64_t        dstBytes;        /* destination read and write bytes of the plan */
+    n2d_uint64_t        dstBytesSingle;  /* destination bytes with one n2d_blit per layer */
+}
+n2d_compose_report_t;
+
 n2d_error_t
 n2d_util_allocate_buffer(
     n2d_uint32_t width,
@@ -164,6 +187,22 @@ n2d_util_load_buffer_from_comfile(
     n2d_tile_status_config_t TilestatusConfig,
     n2d_buffer_t             *buffer);
 
+/*
+ * Draws layers into dst in zorder with the fewest destination passes.
+ * Parts covered by a layer above are clipped out only when that layer is
+ * opaque and its blend is a plain source copy (N2D_BLEND_NONE or
+ * N2D_BLEND_SRC), other blends read what is below. The rest of the layers are
+ * grouped into n2d_multisource_blit passes of up to N2D_COMPOSE_SOURCE_MAX
+ * sources. Scaled layers go through n2d_filterblit. Commands are queued, the
+ * caller commits them (or records them with n2d_cmdlist_begin).
+ */
+n2d_error_t
+n2d_util_compose(
+    n2d_buffer_t *dst,
+    n2d_compose_layer_t *layers,
+    n2d_uint32_t layer_count,
+    n2d_compose_report_t *report);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,415 @@
+/***
+ *                     COPYRIGHT NOTICE
+ *            Copyright (C) 2019 -2023, Horizon Robotics Co., Ltd.
+ *                   All rights reserved.
+ ***/
+#ifndef HB_MEDIA_CODEC_SCHEDULER_H
+#define HB_MEDIA_CODEC_SCHEDULER_H
+
+#include "hb_media_basic_types.h"
+#include "hb_media_codec.h"
+#include "hb_media_error.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#define MC_SCHEDULER_MAX_STREAM_NUM 32
+
+/**
+ * Define the media codec scheduler state.
+ **/
+typedef enum _media_codec_scheduler_state {
+    MEDIA_CODEC_SCHEDULER_STATE_NONE = -1,
+    MEDIA_CODEC_SCHEDULER_STATE_UNINITIALIZED,
+    MEDIA_CODEC_SCHEDULER_STATE_INITIALIZED,
+    MEDIA_CODEC_SCHEDULER_STATE_STARTED,
+    MEDIA_CODEC_SCHEDULER_STATE_ERROR,
+    MEDIA_CODEC_SCHEDULER_STATE_TOTAL
+} media_codec_scheduler_state_t;
+
+/**
+ * Define the functions of scheduled stream callback. They are called
+ * from the scheduler worker threads.
+ **/
+typedef struct _mcs_stream_callback {
+    /**
+     * Fill an input buffer dequeued by the scheduler with the frame
+     * announced by hb_mm_cs_queue_ready. It is called once per announced
+     * frame, in deadline order across streams. Return 0 to queue the
+     * buffer into the codec, or HB_MEDIA_ERR_WAIT_TIMEOUT if the frame is
+     * gone, then the buffer is kept and the stream waits for the next
+     * hb_mm_cs_queue_ready.
+     *
+     * - Note: It must not block. It's required, hb_mm_cs_add_stream returns
+     *   HB_MEDIA_ERR_INVALID_PARAMS if it's NULL.
+     * - Default: NULL
+     */
+    hb_s32 (*on_fill_input_buffer)(hb_ptr userdata,
+            media_codec_buffer_t *buffer);
+
+    /**
+     * Consume an output buffer. The scheduler queues the buffer back
+     * into the codec after the callback returns.
+     *
+     * - Note: It must not block.
+     * - Default: NULL
+     */
+    void (*on_output_buffer_available)(hb_ptr userdata,
+            media_codec_buffer_t *buffer,
+            media_codec_output_buffer_info_t *info);
+
+    /**
+     * Notify an internal message of the stream codec.
+     *
+     * - Note:
+     * - Default: NULL
+     */
+    void (*on_media_codec_message)(hb_ptr userdata, hb_s32 error);
+} mcs_stream_callback_t;
+
+/**
+ * Define the scheduling parameters of a stream.
+ **/
+typedef struct _mcs_stream_params {
+    /**
+     * Stream priority. It breaks the tie between streams with the same
+     * deadline and is passed to the codec command queue.
+     * Values[@see mc_video_cmd_prio_t]
+     *
+     * - Note:
+     * - Default: PRIO_0
+     */
+    mc_video_cmd_prio_t priority;
+
+    /**
+     * Latency budget in us from the frame capture to the output buffer
+     * being available. Deadline of each frame is the capture time given
+     * by hb_mm_cs_queue_ready plus the budget, and the earliest deadline
+     * is filled and served first.
+     * Values[0,], 0 means the frame interval of the stream.
+     *
+     * - Note:
+     * - Default: 0
+     */
+    hb_u32 latency_budget_us;
+
+    /**
+     * Max frames queued into the codec and not dequeued yet.
+     * Values[0,], 0 means 2
+     *
+     * - Note:
+     * - Default: 2
+     */
+    hb_u32 max_queue_depth;
+} mcs_stream_params_t;
+
+/**
+ * Define the statistics of a scheduled stream.
+ **/
+typedef struct _mcs_stream_stats {
+    /**
+     * Frames currently queued into the codec.
+     */
+    hb_u32 queue_depth;
+
+    /**
+     * Total input and output frame count.
+     */
+    hb_u64 frames_in;
+    hb_u64 frames_out;
+
+    /**
+     * Frames whose output came later than the deadline.
+     */
+    hb_u64 deadline_miss;
+
+    /**
+     * Capture-to-output latency in us.
+     */
+    hb_u32 latency_avg_us;
+    hb_u32 latency_p99_us;
+    hb_u32 latency_max_us;
+} mcs_stream_stats_t;
+
+/**
+ * Define the parameters of media codec scheduler context.
+ **/
+typedef struct _media_codec_scheduler_context {
+    /**
+     * Worker thread number shared by all streams.
+     * Values[1,8]
+     *
+     * - Note: It's unchangable parameters in the same sequence.
+     * - Default: 2
+     */
+    hb_u32 worker_num;
+
+    /**
+     * Private data. Users must not modify this value!!!
+     * Values[0,31]
+     * - Note:
+     * - Default: -1
+     */
+    hb_s32 instance_index;
+} media_codec_scheduler_context_t;
+
+/**
+ * @NO{S07E06C01I}
+ * @ASIL{QM}
+ * @brief Get the default media codec scheduler context.
+ *
+ * @param[out] context: scheduler context, see media_codec_scheduler_context_t
+ *
+ * @retval =0: Success
+ * @retval HB_MEDIA_ERR_INVALID_PARAMS: Invalid parameter
+ *
+ * @data_read None
+ * @data_updated None
+ * @compatibility HW: J6
+ * @compatibility SW: v1.3.0
+ *
+ * @callgraph
+ * @callergraph
+ * @design
+ */
+extern hb_s32 hb_mm_cs_get_default_context(
+				media_codec_scheduler_context_t *context);
+
+/**
+ * @NO{S07E06C01I}
+ * @ASIL{QM}
+ * @brief Initialize the media codec scheduler and create the worker threads.
+ * If success, the scheduler will enter into MEDIA_CODEC_SCHEDULER_STATE_INITIALIZED state.
+ *
+ * @param[in] context: scheduler context, see media_codec_scheduler_context_t
+ *
+ * @retval =0: Success
+ * @retval HB_MEDIA_ERR_INVALID_PARAMS: Invalid parameter
+ * @retval HB_MEDIA_ERR_OPERATION_NOT_ALLOWED: Disallowed operation
+ * @retval HB_MEDIA_ERR_INSUFFICIENT_RES: Insufficient resources
+ * @retval HB_MEDIA_ERR_NO_FREE_INSTANCE: No available instance
+ *
+ * @data_read None
+ * @data_updated None
+ * @compatibility HW: J6
+ * @compatibility SW: v1.3.0
+ *
+ * @callgraph
+ * @callergraph
+ * @design
+ */
+extern hb_s32 hb_mm_cs_initialize(media_codec_scheduler_context_t *context);
+
+/**
+ * @NO{S07E06C01I}
+ * @ASIL{QM}
+ * @brief Attach a configured codec to the scheduler. The scheduler installs
+ * its own media_codec_callback_t by hb_mm_mc_set_callback, so the codec must be
+ * in MEDIA_CODEC_STATE_CONFIGURED state and must not have a callback. The codec
+ * is started by hb_mm_cs_start or at once if the scheduler is started.
+ *
+ * @param[in] context: scheduler context, see media_codec_scheduler_context_t
+ * @param[in] codec: configured codec context
+ * @param[in] params: scheduling parameters, see mcs_stream_params_t
+ * @param[in] callback: stream callback, see mcs_stream_callback_t
+ * @param[in] userdata: pointer to user data passed to the stream callback
+ *
+ * @retval =0: Success
+ * @retval HB_MEDIA_ERR_INVALID_PARAMS: Invalid parameter or NULL on_fill_input_buffer
+ * @retval HB_MEDIA_ERR_OPERATION_NOT_ALLOWED: Disallowed operation
+ * @retval HB_MEDIA_ERR_INSUFFICIENT_RES: More than MC_SCHEDULER_MAX_STREAM_NUM streams
+ * @retval HB_MEDIA_ERR_INVALID_INSTANCE: invalid instance
+ * @retval HB_MEDIA_ERR_INVALID_PRIORITY: Invalid priority
+ *
+ * @data_read None
+ * @data_updated None
+ * @compatibility HW: J6
+ * @compatibility SW: v1.3.0
+ *
+ * @callgraph
+ * @callergraph
+ * @design
+ */
+extern hb_s32 hb_mm_cs_add_stream(media_codec_scheduler_context_t *context,
+				media_codec_context_t *codec,
+				const mcs_stream_params_t *params,
+				const mcs_stream_callback_t *callback, hb_ptr userdata);
+
+/**
+ * @NO{S07E06C01I}
+ * @ASIL{QM}
+ * @brief Detach a codec from the scheduler. The queued frames are drained
+ * and the codec is stopped.
+ *
+ * @param[in] context: scheduler context, see media_codec_scheduler_context_t
+ * @param[in] codec: codec context passed to hb_mm_cs_add_stream
+ *
+ * @retval =0: Success
+ * @retval HB_MEDIA_ERR_INVALID_PARAMS: Invalid parameter
+ * @retval HB_MEDIA_ERR_INVALID_INSTANCE: invalid instance
+ *
+ * @data_read None
+ * @data_updated None
+ * @compatibility HW: J6
+ * @compatibility SW: v1.3.0
+ *
+ * @callgraph
+ * @callergraph
+ * @design
+ */
+extern hb_s32 hb_mm_cs_remove_stream(media_codec_scheduler_context_t *context,
+				media_codec_context_t *codec);
+
+/**
+ * @NO{S07E06C01I}
+ * @ASIL{QM}
+ * @brief Start all attached codecs and the dispatching. If success, the
+ * scheduler will enter into MEDIA_CODEC_SCHEDULER_STATE_STARTED state.
+ *
+ * @param[in] context: scheduler context, see media_codec_scheduler_context_t
+ *
+ * @retval =0: Success
+ * @retval HB_MEDIA_ERR_UNKNOWN: Unknow error
+ * @retval HB_MEDIA_ERR_OPERATION_NOT_ALLOWED: Disallowed operation
+ * @retval HB_MEDIA_ERR_INVALID_INSTANCE: invalid instance
+ *
+ * @data_read None
+ * @data_updated None
+ * @compatibility HW: J6
+ * @compatibility SW: v1.3.0
+ *
+ * @callgraph
+ * @callergraph
+ * @design
+ */
+extern hb_s32 hb_mm_cs_start(media_codec_scheduler_context_t *context);
+
+/**
+ * @NO{S07E06C01I}
+ * @ASIL{QM}
+ * @brief Stop the dispatching and all attached codecs. If success, the
+ * scheduler will enter into MEDIA_CODEC_SCHEDULER_STATE_INITIALIZED state.
+ *
+ * @param[in] context: scheduler context, see media_codec_scheduler_context_t
+ *
+ * @retval =0: Success
+ * @retval HB_MEDIA_ERR_OPERATION_NOT_ALLOWED: Disallowed operation
+ * @retval HB_MEDIA_ERR_INVALID_INSTANCE: invalid instance
+ *
+ * @data_read None
+ * @data_updated None
+ * @compatibility HW: J6
+ * @compatibility SW: v1.3.0
+ *
+ * @callgraph
+ * @callergraph
+ * @design
+ */
+extern hb_s32 hb_mm_cs_stop(media_codec_scheduler_context_t *context);
+
+/**
+ * @NO{S07E06C01I}
+ * @ASIL{QM}
+ * @brief Release the scheduler and its worker threads. All streams must be
+ * removed before. If success, the scheduler will enter into
+ * MEDIA_CODEC_SCHEDULER_STATE_UNINITIALIZED state.
+ *
+ * @param[in] context: scheduler context, see media_codec_scheduler_context_t
+ *
+ * @retval =0: Success
+ * @retval HB_MEDIA_ERR_OPERATION_NOT_ALLOWED: Disallowed operation
+ * @retval HB_MEDIA_ERR_INVALID_INSTANCE: invalid instance
+ *
+ * @data_read None
+ * @data_updated None
+ * @compatibility HW: J6
+ * @compatibility SW: v1.3.0
+ *
+ * @callgraph
+ * @callergraph
+ * @design
+ */
+extern hb_s32 hb_mm_cs_release(media_codec_scheduler_context_t *context);
+
+/**
+ * @NO{S07E06C01I}
+ * @ASIL{QM}
+ * @brief Announce that a new frame of a stream is ready to be filled. It
+ * wakes a worker, which calls on_fill_input_buffer of the stream when its
+ * deadline is the earliest, so workers do not poll the streams.
+ *
+ * @param[in] context: scheduler context, see media_codec_scheduler_context_t
+ * @param[in] codec: codec context passed to hb_mm_cs_add_stream
+ * @param[in] capture_time_us: capture time of the frame in CLOCK_MONOTONIC us,
+ *                  e.g. the pts of the frame when it is the capture time
+ *
+ * @retval =0: Success
+ * @retval HB_MEDIA_ERR_INVALID_PARAMS: Invalid parameter
+ * @retval HB_MEDIA_ERR_INVALID_INSTANCE: invalid instance
+ *
+ * @data_read None
+ * @data_updated None
+ * @compatibility HW: J6
+ * @compatibility SW: v1.3.0
+ *
+ * @callgraph
+ * @callergraph
+ * @design
+ */
+extern hb_s32 hb_mm_cs_queue_ready(media_codec_scheduler_context_t *context,
+				media_codec_context_t *codec, hb_u64 capture_time_us);
+
+/**
+ * @NO{S07E06C01I}
+ * @ASIL{QM}
+ * @brief Get the statistics of a scheduled stream.
+ *
+ * @param[in] context: scheduler context, see media_codec_scheduler_context_t
+ * @param[in] codec: codec context passed to hb_mm_cs_add_stream
+ * @param[out] stats: stream statistics, see mcs_stream_stats_t
+ *
+ * @retval =0: Success
+ * @retval HB_MEDIA_ERR_INVALID_PARAMS: Invalid parameter
+ * @retval HB_MEDIA_ERR_INVALID_INSTANCE: invalid instance
+ *
+ * @data_read None
+ * @data_updated None
+ * @compatibility HW: J6
+ * @compatibility SW: v1.3.0
+ *
+ * @callgraph
+ * @callergraph
+ * @design
+ */
+extern hb_s32 hb_mm_cs_get_stream_stats(media_codec_scheduler_context_t *context,
+				media_codec_context_t *codec, mcs_stream_stats_t *stats);
+
+/**
+ * @NO{S07E06C01I}
+ * @ASIL{QM}
+ * @brief Get the state of media codec scheduler.
+ *
+ * @param[in] context: scheduler context, see media_codec_scheduler_context_t
+ * @param[out] state: scheduler state
+ *
+ * @retval =0: Success
+ * @retval HB_MEDIA_ERR_INVALID_PARAMS: Invalid parameter
+ * @retval HB_MEDIA_ERR_INVALID_INSTANCE: invalid instance
+ *
+ * @data_read None
+ * @data_updated None
+ * @compatibility HW: J6
+ * @compatibility SW: v1.3.0
+ *
+ * @callgraph
+ * @callergraph
+ * @design
+ */
+extern hb_s32 hb_mm_cs_get_state(media_codec_scheduler_context_t *context,
+				media_codec_scheduler_state_t *state);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* HB_MEDIA_CODEC_SCHEDULER_H */
@@ -32,9 +32,24 @@ typedef enum _mx_output_format {
     /* Media muxer chooses the default media format "MP4" */
     MEDIA_MUXER_OUTPUT_FORMAT_DEFAULT = 0,
     MEDIA_MUXER_OUTPUT_FORMAT_MP4,
+    /* Fragmented MP4 (CMAF): moov is written at start and samples are
+     * streamed in moof/mdat fragments, see fragment_duration */
+    MEDIA_MUXER_OUTPUT_FORMAT_FMP4,
     MEDIA_MUXER_OUTPUT_FORMAT_TOTAL,
 } mx_output_format_t;
 
+/**
+ * Define the write mode of media muxer.
+ **/
+typedef enum _mx_write_mode {
+    /* Stream data is copied into the muxer buffer at hb_mm_mx_write_stream */
+    MEDIA_MUXER_WRITE_MODE_COPY = 0,
+    /* Stream data is held by reference and written with writev,
+     * see hb_mm_mx_write_stream_ref */
+    MEDIA_MUXER_WRITE_MODE_ZERO_COPY,
+    MEDIA_MUXER_WRITE_MODE_TOTAL,
+} mx_write_mode_t;
+
 /**
  * Define the input format of audio stream.
  **/
@@ -245,6 +260,14 @@ typedef struct _mx_stream {
     hb_bool is_key_frame;
 } mx_stream_t;
 
+/**
+ * Define the release function of a referenced stream buffer. It's called
+ * from the muxer writer thread once the buffer data is on the file, then
+ * the buffer can be returned to the codec by hb_mm_mc_queue_output_buffer.
+ **/
+typedef void (*mx_stream_release_callback)(hb_ptr userdata,
+                 const mx_stream_t *buffer);
+
 /**
  * Define the parameters of media muxer context.
  **/
@@ -267,6 +290,37 @@ typedef struct _media_muxer_context {
      */
     mx_output_format_t output_format;
 
+    /**
+     * Specify the write mode.
+     * The valid values @see mx_write_mode_t.
+     *
+     * - Note: It's unchangable parameters in the same sequence.
+     * - Default: MEDIA_MUXER_WRITE_MODE_COPY
+     */
+    mx_write_mode_t write_mode;
+
+    /**
+     * Max stream buffers held by reference in zero copy mode.
+     * hb_mm_mx_write_stream_ref blocks when the limit is reached.
+     * Values[1,64]
+     *
+     * - Note: It's unchangable parameters in the same sequence.
+     * - Default: 8
+     */
+    hb_s32 max_ref_buffers;
+
+    /**
+     * Fragment duration in ms of MEDIA_MUXER_OUTPUT_FORMAT_FMP4. A fragment
+     * is closed once the duration is reached whether or not the next frame
+     * is a key frame, so the muxer memory is bounded by fragment_duration of
+     * stream data and the file is never seeked back.
+     * Values[100,10000]
+     *
+     * - Note: It's unchangable parameters in the same sequence.
+     * - Default: 1000
+     */
+    hb_s32 fragment_duration;
+
     /**
      * Private data. Users must not modify this value!!!
      * Values[0,31]
@@ -432,6 +486,41 @@ extern hb_s32 hb_mm_mx_stop(media_muxer_context_t *context);
 extern hb_s32 hb_mm_mx_write_stream(media_muxer_context_t *context,
 				const mx_stream_t *buffer);
 
+/**
+ * @NO{S07E04C01I}
+ * @ASIL{QM}
+ * @brief Write the audio/video stream without copy. The muxer keeps a
+ * reference to buffer->vir_ptr, writes the pending buffers and box headers
+ * together with one writev, and calls release after the write is done.
+ * Only valid in MEDIA_MUXER_WRITE_MODE_ZERO_COPY mode. The buffer must not be
+ * modified or returned to the codec until release is called.
+ *
+ * @param[in] context: muxer context, see media_muxer_context_t
+ * @param[in] buffer: muxer buffer, see mx_stream_t
+ * @param[in] release: release function, see mx_stream_release_callback
+ * @param[in] userdata: pointer to user data passed to release
+ *
+ * @retval =0: Success
+ * @retval HB_MEDIA_ERR_UNKNOWN: Unknow error
+ * @retval HB_MEDIA_ERR_OPERATION_NOT_ALLOWED: Disallowed operation
+ * @retval HB_MEDIA_ERR_INVALID_INSTANCE: invalid instance
+ * @retval HB_MEDIA_ERR_INVALID_PARAMS: Invalid parameter
+ * @retval HB_MEDIA_ERR_INVALID_BUFFER: Invalid buffer
+ * @retval HB_MEDIA_ERR_FILE_OPERATION_FAILURE: Can not create or operation file
+ *
+ * @data_read None
+ * @data_updated None
+ * @compatibility HW: J6
+ * @compatibility SW: v1.3.0
+ *
+ * @callgraph
+ * @callergraph
+ * @design
+ */
+extern hb_s32 hb_mm_mx_write_stream_ref(media_muxer_context_t *context,
+				const mx_stream_t *buffer,
+				mx_stream_release_callback release, hb_ptr userdata);
+
 /**
  * @NO{S07E04C01I}
  * @ASIL{QM}
@@ -459,7 +548,7 @@ extern hb_s32 hb_mm_mx_get_state(media_muxer_context_t *context,
 /**
  * @NO{S07E04C01I}
  * @ASIL{QM}
- * @brief Probe the stream to check whether it's normal mp4 file
+ * @brief Probe the stream to check whether it's normal mp4 or fragmented mp4 file
  *
  * @param[in] input_file_name: input file name
  *
@@ -480,10 +569,13 @@ extern hb_s32 hb_mm_mx_probe_stream(hb_string input_file_name);
 /**
  * @NO{S07E04C01I}
  * @ASIL{QM}
- * @brief Repair the damaged mp4 file
+ * @brief Repair the damaged mp4 file. For a fragmented mp4 file only the
+ * last incomplete fragment is checked and dropped. If output_file_name is NULL
+ * or the same as input_file_name, the damaged tail is truncated in place and
+ * the I/O is bounded by the last fragment, otherwise the rest is copied as is.
  *
  * @param[in] input_file_name: input file name
- * @param[in] output_file_name: output file name
+ * @param[in] output_file_name: output file name, NULL to repair in place
  *
  * @retval =0: Success
  * @retval HB_MEDIA_ERR_INVALID_PARAMS: Invalid parameter
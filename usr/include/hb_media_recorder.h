@@ -76,8 +76,27 @@ typedef enum _mr_info {
 
     MR_INFO_MAX_DURATION_REACHED      = 200,
     MR_INFO_MAX_FILESIZE_REACHED      = 201,
+    /* message is the index of the closed segment */
+    MR_INFO_SEGMENT_COMPLETED         = 202,
+    /* message is the index of the segment removed from the ring */
+    MR_INFO_SEGMENT_DELETED           = 203,
 } mr_info_t;
 
+/**
+ * Define the record mode of media recorder.
+ **/
+typedef enum _mr_record_mode {
+    /* Stop recording when max_file_duration or max_file_size is reached */
+    MR_RECORD_MODE_SINGLE = 0,
+    /* Roll over to a new file when max_file_duration or max_file_size is
+     * reached, without stopping the encoder. The recorder calls
+     * hb_mm_mc_request_idr_frame at the trigger and switches on that IDR
+     * frame, so the wait and the size over the limit are bounded by the
+     * frames already queued into the encoder, not by the GOP length */
+    MR_RECORD_MODE_SEGMENT,
+    MR_RECORD_MODE_TOTAL
+} mr_record_mode_t;
+
 /**
  * Define the listener function .
  **/
@@ -288,6 +307,38 @@ typedef struct _media_recorder_context {
      */
     hb_s32 max_file_size;
 
+    /**
+     * Specify the record mode.
+     * The valid values @see mr_record_mode_t.
+     * In MR_RECORD_MODE_SEGMENT mode output_file_name is a printf pattern with
+     * one integer conversion for the segment index, for example
+     * "/data/record_%06d.mp4".
+     *
+     * - Note: It's unchangable parameters in the same sequence.
+     * - Default: MR_RECORD_MODE_SINGLE
+     */
+    mr_record_mode_t record_mode;
+
+    /**
+     * Specify the number of segments kept on disk. The oldest segment is
+     * deleted when a new segment is opened.
+     * Values[>=0], <=0 means no limit
+     *
+     * - Note: It's unchangable parameters in the same sequence.
+     * - Default: 0
+     */
+    hb_s32 max_segment_num;
+
+    /**
+     * Specify the size in bytes to fallocate for the next segment, which is
+     * opened in advance. The unused space is truncated when the segment is closed.
+     * Values[>=0], 0 means max_file_size
+     *
+     * - Note: It's unchangable parameters in the same sequence.
+     * - Default: 0
+     */
+    hb_s32 preallocate_size;
+
     /**
      * Private data. Users must not modify this value!!!
      * Values[0,31]
@@ -661,6 +712,33 @@ extern hb_s32 hb_mm_mr_prepare(media_recorder_context_t *context);
  */
 extern hb_s32 hb_mm_mr_start(media_recorder_context_t *context);
 
+/**
+ * @NO{S07E05C01I}
+ * @ASIL{QM}
+ * @brief Close the current segment and continue in a new segment, without
+ * stopping the encoder. The recorder calls hb_mm_mc_request_idr_frame and the
+ * new segment starts on that IDR frame, so the split takes effect after the
+ * frames already queued into the encoder, not after a full GOP.
+ * Only valid in MR_RECORD_MODE_SEGMENT mode and MEDIA_RECORDER_STATE_STARTED state.
+ *
+ * @param[in] context: recorder context, see media_recorder_context_t
+ *
+ * @retval =0: Success
+ * @retval HB_MEDIA_ERR_UNKNOWN: Unknow error
+ * @retval HB_MEDIA_ERR_OPERATION_NOT_ALLOWED: Disallowed operation
+ * @retval HB_MEDIA_ERR_INVALID_INSTANCE: invalid instance
+ *
+ * @data_read None
+ * @data_updated None
+ * @compatibility HW: J6
+ * @compatibility SW: v1.3.0
+ *
+ * @callgraph
+ * @callergraph
+ * @design
+ */
+extern hb_s32 hb_mm_mr_split_segment(media_recorder_context_t *context);
+
 /**
  * @NO{S07E05C01I}
  * @ASIL{QM}
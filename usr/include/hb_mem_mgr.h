@@ -210,6 +210,35 @@ typedef struct hb_mem_graphic_buf_group_t {
         uint32_t bit_map;		/**< graphic buffer group bitmap*/
 } hb_mem_graphic_buf_group_t;
 
+#define HB_MEM_MAXIMUM_CACHE_RANGE 64		/**< max range number in one batch cache operation*/
+
+/**
+ * @struct hb_mem_cache_range_t
+ * Define the buffer range of batch cache operation.
+ * @NO{S21E04C02I}
+ */
+typedef struct hb_mem_cache_range_t {
+	int32_t fd;			/**< File descriptors of the buffer.*/
+	uint64_t offset;	/**< Range offset in the buffer.*/
+	uint64_t size;		/**< Range size.*/
+} hb_mem_cache_range_t;
+
+#define HB_MEM_MAXIMUM_DMA_DESC 256		/**< max copy descriptor number in one dma submission*/
+
+/**
+ * @struct hb_mem_dma_copy_desc_t
+ * Define the 2D strided copy descriptor of dma copy.
+ * @NO{S21E04C02U}
+ */
+typedef struct hb_mem_dma_copy_desc_t {
+	uint64_t dst_vaddr;		/**< Start address of target hbmem space.*/
+	uint64_t src_vaddr;		/**< Start address of source hbmem space.*/
+	uint32_t width;			/**< Bytes copied per line.*/
+	uint32_t height;		/**< Line count, 0 is treated as 1, a contiguous copy of width bytes.*/
+	uint32_t dst_stride;	/**< Target line stride in byte, not less than width.*/
+	uint32_t src_stride;	/**< Source line stride in byte, not less than width.*/
+} hb_mem_dma_copy_desc_t;
+
 /**
  * @struct hb_mem_buf_queue_t
  * Define the descriptor of buffer queue.
@@ -238,7 +267,7 @@ typedef struct hb_mem_pool_t {
 	int32_t avail_page_cnt;	/**< Available page count.*/
 	int32_t cur_client_cnt;	/**< Current pool client count.*/
 
-	int32_t reserved;		/**< reserved*/
+	int32_t cached_page_cnt;	/**< Pages held by the user space pool cache, counted as unavailable.*/
 } hb_mem_pool_t;
 
 /**
@@ -256,9 +285,58 @@ typedef struct hb_mem_share_pool_t {
 	int32_t total_buf_cnt;	/**< Total buf count.*/
 	int32_t avail_buf_cnt;	/**< Available buffer count.*/
 
-	int32_t reserved;		/**< reserved*/
+	int32_t cached_buf_cnt;	/**< Buffers held by the user space pool cache, counted as unavailable.*/
 } hb_mem_share_pool_t;
 
+#define HB_MEM_POOL_CACHE_CLASS_MAX 8		/**< max size class number of memory pool cache*/
+
+/**
+ * @struct hb_mem_pool_cache_attr_t
+ * Define the attribute of user space memory pool cache.
+ * @NO{S21E04C02I}
+ */
+typedef struct hb_mem_pool_cache_attr_t {
+/**
+ * Values (0, HB_MEM_POOL_CACHE_CLASS_MAX], ignored by share pool which has one buffer size
+ */
+	uint32_t class_cnt;		/**< Size class count.*/
+	uint64_t class_size[HB_MEM_POOL_CACHE_CLASS_MAX];	/**< Ascending size of each class in byte, requests are rounded up.*/
+/**
+ * - Default: 0, means 16
+ */
+	uint32_t magazine_size;	/**< Buffer count of one per-thread magazine.*/
+/**
+ * - Default: 0, means 4
+ */
+	uint32_t depot_size;	/**< Full magazine count kept in the global depot of each class.*/
+} hb_mem_pool_cache_attr_t;
+
+/**
+ * @struct hb_mem_pool_cache_stat_t
+ * Define the statistics of user space memory pool cache.
+ * @NO{S21E04C02I}
+ */
+typedef struct hb_mem_pool_cache_stat_t {
+	uint64_t alloc_cnt;		/**< Total alloc count through the cache.*/
+	uint64_t free_cnt;		/**< Total free count through the cache.*/
+	uint64_t thread_hit_cnt;	/**< Alloc count served by the calling thread magazine.*/
+	uint64_t depot_hit_cnt;	/**< Alloc count served by a magazine from the global depot.*/
+	uint64_t miss_cnt;		/**< Alloc count served by the driver.*/
+	uint64_t cached_size;	/**< Total size in byte currently held by magazines and depot.*/
+} hb_mem_pool_cache_stat_t;
+
+/**
+ * @enum hb_mem_backend_t
+ * @brief Define the allocator backend of memory module.
+ * @NO{S21E04C02I}
+ */
+typedef enum hb_mem_backend_t {
+	HB_MEM_BACKEND_ION,		/**< buffers are allocated from ION/dma heaps, the default backend on target*/
+	HB_MEM_BACKEND_MEMFD,	/**< buffers are memfd pages for host runs, phys_addr is always 0 and
+							 * cache operations are no-ops*/
+	HB_MEM_BACKEND_MAX,		/**< the backend max index*/
+} hb_mem_backend_t;
+
 /**
  * @NO{S21E04C02I}
  * @ASIL{B}
@@ -302,6 +380,33 @@ int32_t hb_mem_get_version(uint32_t *major, uint32_t *minor, uint32_t *patch);
  */
 int32_t hb_mem_module_open(void);
 
+/**
+ * @NO{S21E04C02I}
+ * @ASIL{B}
+ * @brief Open the memory module with the specified allocator backend.
+ * hb_mem_module_open() is equal to HB_MEM_BACKEND_ION. With HB_MEM_BACKEND_MEMFD
+ * every buffer is backed by an anonymous memfd, so the buffer fd can still be
+ * shared and imported, while the heap flags in @mem_usage_t are ignored.
+ *
+ * @param[in] backend: allocator backend @hb_mem_backend_t
+ *
+ * @retval "0": succeed
+ * @retval "HB_MEM_ERR_INVALID_PARAMS": invalid parameter
+ * @retval "HB_MEM_ERR_MODULE_OPEN_FAIL": Unable to open memory module
+ * @retval "HB_MEM_ERR_INSUFFICIENT_MEM": out of memory
+ * @retval "HB_MEM_ERR_NOT_ALLOW": The memory module is already open with another backend
+ *
+ * @data_read None
+ * @data_updated None
+ * @compatibility HW: J6
+ * @compatibility SW: 0.2.0
+ *
+ * @callgraph
+ * @callergraph
+ * @design
+ */
+int32_t hb_mem_module_open_with_backend(hb_mem_backend_t backend);
+
 /**
  * @NO{S21E04C02I}
  * @ASIL{B}
@@ -516,6 +621,110 @@ int32_t hb_mem_invalidate_buf(int32_t fd, uint64_t offset, uint64_t size);
  */
 int32_t hb_mem_flush_buf(int32_t fd, uint64_t offset, uint64_t size);
 
+/**
+ * @NO{S21E04C02I}
+ * @ASIL{B}
+ * @brief Invalidate a batch of buffer ranges in one driver call. Overlapping and adjacent
+ * ranges of the same buffer are merged, and ranges of non-cached buffers are skipped.
+ *
+ * @param[in] ranges: buffer range array @hb_mem_cache_range_t
+ * @param[in] num: range number
+				  range: (0, HB_MEM_MAXIMUM_CACHE_RANGE]; default: 0
+ *
+ * @retval "0": succeed
+ * @retval "HB_MEM_ERR_MODULE_NOT_FOUND": The memory module is not open
+ * @retval "HB_MEM_ERR_INVALID_PARAMS": invalid parameter
+ * @retval "HB_MEM_ERR_INVALID_FD": File handle exception
+ *
+ * @data_read None
+ * @data_updated None
+ * @compatibility HW: J6
+ * @compatibility SW: 0.2.0
+ *
+ * @callgraph
+ * @callergraph
+ * @design
+ */
+int32_t hb_mem_invalidate_buf_batch(const hb_mem_cache_range_t *ranges, uint32_t num);
+
+/**
+ * @NO{S21E04C02I}
+ * @ASIL{B}
+ * @brief Invalidate the planes of the selected graphic buffers in a group in one driver call.
+ * Non-cached buffers are skipped.
+ *
+ * @param[in] buf_group: the graphic buffer group
+ * @param[in] bitmap: the graphic buffers to invalidate, bit i is buf_group->graph_group[i],
+					  only the bits set in buf_group->bit_map are used
+ *
+ * @retval "0": succeed
+ * @retval "HB_MEM_ERR_MODULE_NOT_FOUND": The memory module is not open
+ * @retval "HB_MEM_ERR_INVALID_PARAMS": invalid parameter
+ * @retval "HB_MEM_ERR_INVALID_FD": File handle exception
+ *
+ * @data_read None
+ * @data_updated None
+ * @compatibility HW: J6
+ * @compatibility SW: 0.2.0
+ *
+ * @callgraph
+ * @callergraph
+ * @design
+ */
+int32_t hb_mem_invalidate_graph_buf_group(const hb_mem_graphic_buf_group_t *buf_group, uint32_t bitmap);
+
+/**
+ * @NO{S21E04C02I}
+ * @ASIL{B}
+ * @brief Flush a batch of buffer ranges in one driver call. Overlapping and adjacent
+ * ranges of the same buffer are merged, and ranges of non-cached buffers are skipped.
+ *
+ * @param[in] ranges: buffer range array @hb_mem_cache_range_t
+ * @param[in] num: range number
+				  range: (0, HB_MEM_MAXIMUM_CACHE_RANGE]; default: 0
+ *
+ * @retval "0": succeed
+ * @retval "HB_MEM_ERR_MODULE_NOT_FOUND": The memory module is not open
+ * @retval "HB_MEM_ERR_INVALID_PARAMS": invalid parameter
+ * @retval "HB_MEM_ERR_INVALID_FD": File handle exception
+ *
+ * @data_read None
+ * @data_updated None
+ * @compatibility HW: J6
+ * @compatibility SW: 0.2.0
+ *
+ * @callgraph
+ * @callergraph
+ * @design
+ */
+int32_t hb_mem_flush_buf_batch(const hb_mem_cache_range_t *ranges, uint32_t num);
+
+/**
+ * @NO{S21E04C02I}
+ * @ASIL{B}
+ * @brief Flush the planes of the selected graphic buffers in a group in one driver call.
+ * Non-cached buffers are skipped.
+ *
+ * @param[in] buf_group: the graphic buffer group
+ * @param[in] bitmap: the graphic buffers to flush, bit i is buf_group->graph_group[i],
+					  only the bits set in buf_group->bit_map are used
+ *
+ * @retval "0": succeed
+ * @retval "HB_MEM_ERR_MODULE_NOT_FOUND": The memory module is not open
+ * @retval "HB_MEM_ERR_INVALID_PARAMS": invalid parameter
+ * @retval "HB_MEM_ERR_INVALID_FD": File handle exception
+ *
+ * @data_read None
+ * @data_updated None
+ * @compatibility HW: J6
+ * @compatibility SW: 0.2.0
+ *
+ * @callgraph
+ * @callergraph
+ * @design
+ */
+int32_t hb_mem_flush_graph_buf_group(const hb_mem_graphic_buf_group_t *buf_group, uint32_t bitmap);
+
 /**
  * @NO{S21E04C02I}
  * @ASIL{B}
@@ -1202,6 +1411,87 @@ int32_t hb_mem_pool_free_buf(uint64_t virt_addr);
  */
 int32_t hb_mem_pool_get_info(int32_t fd, hb_mem_pool_t * pool);
 
+/**
+ * @NO{S21E04C02I}
+ * @ASIL{B}
+ * @brief Enable the user space cache of memory pool or share memory pool.
+ * Freed buffers are kept in per-thread magazines of their size class and
+ * in a lock-free global depot, so hb_mem_pool_alloc_buf/hb_mem_pool_free_buf and
+ * hb_mem_share_pool_alloc_buf/hb_mem_share_pool_free_buf don't enter the driver
+ * on a cache hit. Magazines of an exited thread are moved to the depot.
+ *
+ * @param[in] fd: the fd of memory pool or share memory pool
+				  range: [0, ); default: 0
+ * @param[in] attr: the cache attribute @hb_mem_pool_cache_attr_t
+ *
+ * @retval "0": succeed
+ * @retval "HB_MEM_ERR_MODULE_NOT_FOUND": The memory module is not open
+ * @retval "HB_MEM_ERR_INVALID_PARAMS": invalid parameter
+ * @retval "HB_MEM_ERR_INSUFFICIENT_MEM": out of memory
+ * @retval "HB_MEM_ERR_POOL_NOT_FOUND": Can not find the memory pool
+ * @retval "HB_MEM_ERR_NOT_ALLOW": The cache of the memory pool is already enabled
+ *
+ * @data_read None
+ * @data_updated None
+ * @compatibility HW: J6
+ * @compatibility SW: 0.2.0
+ *
+ * @callgraph
+ * @callergraph
+ * @design
+ */
+int32_t hb_mem_pool_cache_enable(int32_t fd, const hb_mem_pool_cache_attr_t *attr);
+
+/**
+ * @NO{S21E04C02I}
+ * @ASIL{B}
+ * @brief Disable the user space cache of memory pool and return all cached buffers to the driver.
+ * It should be called before hb_mem_pool_destroy/hb_mem_share_pool_destroy.
+ *
+ * @param[in] fd: the fd of memory pool or share memory pool
+				  range: [0, ); default: 0
+ *
+ * @retval "0": succeed
+ * @retval "HB_MEM_ERR_MODULE_NOT_FOUND": The memory module is not open
+ * @retval "HB_MEM_ERR_INVALID_PARAMS": invalid parameter
+ * @retval "HB_MEM_ERR_POOL_NOT_FOUND": Can not find the memory pool
+ *
+ * @data_read None
+ * @data_updated None
+ * @compatibility HW: J6
+ * @compatibility SW: 0.2.0
+ *
+ * @callgraph
+ * @callergraph
+ * @design
+ */
+int32_t hb_mem_pool_cache_disable(int32_t fd);
+
+/**
+ * @NO{S21E04C02I}
+ * @ASIL{B}
+ * @brief Get the statistics of memory pool cache.
+ *
+ * @param[in] fd: the fd of memory pool or share memory pool
+				  range: [0, ); default: 0
+ * @param[out] stat: the cache statistics @hb_mem_pool_cache_stat_t
+ *
+ * @retval "0": succeed
+ * @retval "HB_MEM_ERR_MODULE_NOT_FOUND": The memory module is not open
+ * @retval "HB_MEM_ERR_INVALID_PARAMS": invalid parameter
+ * @retval "HB_MEM_ERR_POOL_NOT_FOUND": Can not find the memory pool
+ *
+ * @data_read None
+ * @data_updated None
+ * @compatibility HW: J6
+ * @compatibility SW: 0.2.0
+ *
+ * @callgraph
+ * @callergraph
+ * @design
+ */
+int32_t hb_mem_pool_cache_get_info(int32_t fd, hb_mem_pool_cache_stat_t *stat);
+
 /**
  * @NO{S21E04C02I}
  * @ASIL{B}
@@ -1696,6 +1986,61 @@ int32_t hb_mem_import_com_buf_with_paddr(uint64_t phys_addr,
  */
 int32_t hb_mem_dma_copy(uint64_t dst_vaddr, uint64_t src_vaddr, uint64_t size);
 
+/**
+ * @NO{S21E04C02U}
+ * @ASIL{B}
+ * @brief Submit a list of 2D strided copies to the system's dma and return without waiting.
+ * All descriptors are executed in one submission. The fence fd becomes readable when the
+ * whole list is done, it can be polled or waited with hb_mem_dma_wait_fence, and must be
+ * closed by close() after use. With HB_MEM_BACKEND_MEMFD the copies are done by memcpy
+ * and the fence is signaled at return.
+ *
+ * @param[in] descs: copy descriptor array @hb_mem_dma_copy_desc_t
+ * @param[in] num: descriptor number
+				  range: (0, HB_MEM_MAXIMUM_DMA_DESC]; default: 0
+ * @param[out] fence_fd: completion fence fd
+ *
+ * @retval "=0": succeed
+ * @retval "HB_MEM_ERR_MODULE_NOT_FOUND": The memory module is not open
+ * @retval "HB_MEM_ERR_INVALID_PARAMS": invalid parameter
+ * @retval "HB_MEM_ERR_INVALID_VADDR": The virtual address is abnormal. There is an abnormal virtual address
+ * @retval "HB_MEM_ERR_TOO_MANY_FD": The number of file handles exceeds the maximum
+ *
+ * @data_read None
+ * @data_updated None
+ * @compatibility HW: J6
+ * @compatibility SW: 0.2.0
+ *
+ * @callgraph
+ * @callergraph
+ * @design
+ */
+int32_t hb_mem_dma_copy_async(const hb_mem_dma_copy_desc_t *descs, uint32_t num, int32_t *fence_fd);
+
+/**
+ * @NO{S21E04C02U}
+ * @ASIL{B}
+ * @brief Wait the fence returned by hb_mem_dma_copy_async.
+ *
+ * @param[in] fence_fd: completion fence fd
+ * @param[in] timeout: timeout in ms, <0 means wait forever, 0 means only check
+ *
+ * @retval "=0": succeed, the copies are done
+ * @retval "HB_MEM_ERR_INVALID_FD": File handle exception
+ * @retval "HB_MEM_ERR_TIMEOUT": Timeout to wait operation finishing
+ * @retval "HB_MEM_ERR_UNKNOWN": The dma transfer failed
+ *
+ * @data_read None
+ * @data_updated None
+ * @compatibility HW: J6
+ * @compatibility SW: 0.2.0
+ *
+ * @callgraph
+ * @callergraph
+ * @design
+ */
+int32_t hb_mem_dma_wait_fence(int32_t fence_fd, int64_t timeout);
+
 /**
  * @NO{S21E04C02I}
  * @ASIL{B}
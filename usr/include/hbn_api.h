@@ -28,6 +28,8 @@ extern "C" {
 #define HBN_PIPELINE_BIND_MAX 16u /**< vio pipeline max bind count  @NO{S09E05C02U}  */
 #define HBN_GETFRAME_TIMEOUT 1000 //1000ms for dvb
 #define HBN_MAX_VNODE_CONFIG 8
+#define HBN_FRAME_RING_DEPTH_MAX 32u // must be power of 2
+#define HBN_FRAME_RING_CONSUMER_MAX 4u // rings per ochn
 
 #define VIN_MODULE 0u
 #define ISP_MODULE 1u
@@ -42,6 +44,7 @@ extern "C" {
 
 typedef int64_t hbn_vnode_handle_t;
 typedef int64_t hbn_vflow_handle_t;
+typedef int64_t hbn_frame_ring_handle_t;
 
 //typedef struct hbn_frame_info_s {
 //	uint32_t frame_id;
@@ -225,6 +228,7 @@ typedef enum hb_vnode_type_e {
 	HB_ISP_RB, // X5
 	HB_VSE, // X5
 	HB_N2D, // X5
+	HB_SYNC, // frame sync aggregation, see sync_cfg.h
 	HB_VNODE_TYPE_MAX
 } hb_vnode_type;
 
@@ -262,6 +266,51 @@ typedef struct hbn_version_s {
 
 typedef int32_t hobot_status;
 
+typedef struct hbn_vnode_frame_req_s {
+	hbn_vnode_handle_t vnode_fd; // in
+	uint32_t ochn_id; // in
+	uint32_t group; // in, 1: get as hbn_vnode_getframe_group into image_group, for pym outputs
+	hobot_status status; // out, HBN_STATUS_SUCESS when image/image_group is valid, HBN_STATUS_FRAME_NOT_READY if not ready
+	hbn_vnode_image_t image; // out when group is 0, release by hbn_vnode_releaseframe
+	hbn_vnode_image_group_t *image_group; // in when group is 1, caller storage filled as out, release by hbn_vnode_releaseframe_group
+} hbn_vnode_frame_req_t;
+
+typedef struct hbn_frame_ring_attr_s {
+	uint32_t depth; // descriptor slots, power of 2, <= HBN_FRAME_RING_DEPTH_MAX
+	uint32_t drop_oldest; // 1: producer recycles the oldest published but not acquired frame when full, acquired frames are never recycled; 0: producer waits
+	uint32_t group; // 1: slots hold hbn_vnode_image_group_t, for pym outputs
+	uint32_t reserved[5];
+} hbn_frame_ring_attr_t;
+
+// Valid tiling/compression pairs, in negotiation preference order: a higher value is preferred.
+// DEC compressed layouts keep the tile status in the plane after the image planes.
+typedef enum hbn_buf_layout_e {
+	HBN_BUF_LAYOUT_LINEAR = 0, // N2D_LINEAR, default, the only layout for CPU access
+	HBN_BUF_LAYOUT_TILED, // N2D_TILED
+	HBN_BUF_LAYOUT_TILED_8X8_XMAJOR, // N2D_TILED_8X8_XMAJOR
+	HBN_BUF_LAYOUT_SUPER_TILED, // N2D_SUPER_TILED
+	HBN_BUF_LAYOUT_TILED_8X8_XMAJOR_DEC, // N2D_TILED_8X8_XMAJOR + N2D_TSC_DEC_COMPRESSED
+	HBN_BUF_LAYOUT_SUPER_TILED_DEC, // N2D_SUPER_TILED + N2D_TSC_DEC_COMPRESSED
+	HBN_BUF_LAYOUT_MAX
+} hbn_buf_layout_e;
+
+#define HBN_BUF_LAYOUT_CAP(layout) (1u << (layout))
+
+typedef struct hbn_vnode_chn_stats_s {
+	uint64_t frames_in; // frames queued to the channel, by bind or hbn_vnode_sendframe
+	uint64_t frames_out; // frames got by the consumer or the bound vnode
+	uint64_t frames_dropped; // frames recycled without being got, e.g. hbn_vnode_getframe timeout
+	uint64_t starve_cnt; // times the channel had no free buffer to process into
+	uint64_t queue_wait_us; // total time frames waited in the queue before process or get
+	uint64_t queue_wait_max_us;
+	uint64_t proc_time_us; // total hardware process time
+	uint64_t proc_time_max_us;
+	uint32_t queue_depth; // frames in the queue now
+	uint32_t reserved0;
+	uint64_t frames_skipped; // input frames not processed for backpressure, e.g. vse_ochn_attr_ex_t.bp_en
+	uint32_t reserved[4];
+} hbn_vnode_chn_stats_t;
+
 typedef struct vpf_ext_ctrl_t {
 	uint32_t id;
 	void *arg;
@@ -336,12 +385,21 @@ typedef struct {
 } pym_cfg_t;
 // j6 modify end
 
+typedef enum hbn_backend_type_e {
+	HBN_BACKEND_HW = 0, // J6 hardware vnodes, default
+	HBN_BACKEND_SW, // CPU vnodes on memfd buffers for host run, see hbn_sw_cfg.h
+	HBN_BACKEND_MAX
+} hbn_backend_type_t;
 
 
 #define GDC_MAX_INPUT_PLANE (3u)
 
 typedef int32_t hobot_status;
 
+// HBN_STATUS_BACKEND_MISMATCH: hbn_set_backend called with another backend after the first hbn_vnode_open/hbn_vflow_create,
+// or hbn_vnode_open/hbn_vflow_create with HBN_BACKEND_SW while hb_mem is open with HB_MEM_BACKEND_ION.
+hobot_status hbn_set_backend(hbn_backend_type_t backend); // must be called before the first hbn_vnode_open/hbn_vflow_create
+hobot_status hbn_get_backend(hbn_backend_type_t *backend);
 hobot_status hbn_vnode_open(hb_vnode_type vnode_type, uint32_t hw_id, int32_t ctx_id, hbn_vnode_handle_t *vnode_fd);
 void hbn_vnode_close(hbn_vnode_handle_t vnode_fd);
 hobot_status hbn_vnode_set_attr(hbn_vnode_handle_t vnode_fd, void *attr);
@@ -362,7 +420,8 @@ hobot_status hbn_vnode_set_ochn_buf_attr(hbn_vnode_handle_t vnode_fd, uint32_t o
 					 hbn_buf_alloc_attr_t *alloc_attr);
 hobot_status hbn_vnode_start(hbn_vnode_handle_t vnode_fd);
 hobot_status hbn_vnode_stop(hbn_vnode_handle_t vnode_fd);
-hobot_status hbn_vnode_get_fd(hbn_vnode_handle_t vnode_fd, uint32_t ochn_id, int32_t *fd);
+hobot_status hbn_vnode_get_fd(hbn_vnode_handle_t vnode_fd, uint32_t ochn_id,
+			     int32_t *fd); // fd is POLLIN readable when a frame is ready on ochn_id, for epoll
 
 hobot_status hbn_vnode_getframe(hbn_vnode_handle_t vnode_fd, uint32_t ochn_id, uint32_t millisecondTimeout,
 				hbn_vnode_image_t *out_img); // block function;
@@ -372,6 +431,13 @@ hobot_status hbn_vnode_getframe_group(hbn_vnode_handle_t vnode_fd, uint32_t ochn
 				      hbn_vnode_image_group_t *out_img); // block function;
 hobot_status hbn_vnode_getframe_group_cond(hbn_vnode_handle_t vnode_fd, uint32_t ochn_id, uint32_t millisecondTimeout,
 					   int32_t cond_time, hbn_vnode_image_group_t *out_img); // block function;
+hobot_status hbn_vnode_try_getframe(hbn_vnode_handle_t vnode_fd, uint32_t ochn_id,
+				    hbn_vnode_image_t *out_img); // no block function, HBN_STATUS_FRAME_NOT_READY if no frame
+hobot_status hbn_vnode_try_getframe_group(hbn_vnode_handle_t vnode_fd, uint32_t ochn_id,
+					  hbn_vnode_image_group_t *out_img); // no block function, HBN_STATUS_FRAME_NOT_READY if no frame
+hobot_status hbn_vnode_getframe_batch(hbn_vnode_frame_req_t *reqs, uint32_t req_num, uint32_t millisecondTimeout,
+				      uint32_t *ready_num); // block until one frame ready, then get all ready frames,
+							    // not ready reqs get HBN_STATUS_FRAME_NOT_READY
 hobot_status hbn_vnode_sendframe(hbn_vnode_handle_t vnode_fd, uint32_t ichn_id,
 				 hbn_vnode_image_t *img); // 33ms block function
 hobot_status hbn_vnode_sendframe_async(hbn_vnode_handle_t vnode_fd, uint32_t ichn_id,
@@ -379,6 +445,36 @@ hobot_status hbn_vnode_sendframe_async(hbn_vnode_handle_t vnode_fd, uint32_t ich
 hobot_status hbn_vnode_releaseframe(hbn_vnode_handle_t vnode_fd, uint32_t ochn_id, hbn_vnode_image_t *img);
 hobot_status hbn_vnode_releaseframe_group(hbn_vnode_handle_t vnode_fd, uint32_t ochn_id,
 					  hbn_vnode_image_group_t *img_group);
+// Layout negotiation: hbn_vflow_bind_vnode picks the highest hbn_buf_layout_e in both the src ochn caps and every
+// bound dst ichn caps, LINEAR if none. Caps default to HBN_BUF_LAYOUT_CAP(HBN_BUF_LAYOUT_LINEAR).
+// An ochn with a CPU consumer is negotiated as LINEAR: an unbound ochn, or one with hbn_vnode_get_fd,
+// hbn_frame_ring_create or hbn_vnode_getframe* called on it. When the first CPU consumer comes after hbn_vflow_start,
+// the ochn turns LINEAR from the next frame and the call waits for that frame.
+hobot_status hbn_vnode_set_ochn_layout_caps(hbn_vnode_handle_t vnode_fd, uint32_t ochn_id,
+					    uint32_t caps); // HBN_BUF_LAYOUT_CAP bits
+hobot_status hbn_vnode_set_ichn_layout_caps(hbn_vnode_handle_t vnode_fd, uint32_t ichn_id,
+					    uint32_t caps); // HBN_BUF_LAYOUT_CAP bits
+hobot_status hbn_vnode_get_ochn_layout(hbn_vnode_handle_t vnode_fd, uint32_t ochn_id,
+				       hbn_buf_layout_e *layout); // negotiated layout, valid after bind
+hobot_status hbn_vnode_get_stats(hbn_vnode_handle_t vnode_fd, uint32_t ochn_id, hbn_vnode_chn_stats_t *stats);
+hobot_status hbn_vnode_reset_stats(hbn_vnode_handle_t vnode_fd, uint32_t ochn_id);
+hobot_status hbn_vflow_dump_stats(hbn_vflow_handle_t vflow_fd, char *buf,
+				  uint32_t size); // /proc style text, one line per vnode channel
+
+// Shared-memory SPSC ring of frame descriptors per consumer, buffers are imported once at create.
+// acquire/release only update head/tail in user space, the kernel is entered only to sleep on an empty ring.
+hobot_status hbn_frame_ring_create(hbn_vnode_handle_t vnode_fd, uint32_t ochn_id, const hbn_frame_ring_attr_t *attr,
+				   hbn_frame_ring_handle_t *ring_fd);
+void hbn_frame_ring_destroy(hbn_frame_ring_handle_t ring_fd);
+hobot_status hbn_frame_ring_get_fd(hbn_frame_ring_handle_t ring_fd, int32_t *fd); // POLLIN when ring not empty
+hobot_status hbn_frame_ring_acquire(hbn_frame_ring_handle_t ring_fd, uint32_t millisecondTimeout,
+				    hbn_vnode_image_t **img); // 0 timeout is no block
+hobot_status hbn_frame_ring_acquire_group(hbn_frame_ring_handle_t ring_fd, uint32_t millisecondTimeout,
+					  hbn_vnode_image_group_t **img_group); // 0 timeout is no block
+// release in acquire order, HBN_STATUS_RING_ORDER_ERROR if img is not the oldest acquired frame
+hobot_status hbn_frame_ring_release(hbn_frame_ring_handle_t ring_fd, const hbn_vnode_image_t *img);
+hobot_status hbn_frame_ring_release_group(hbn_frame_ring_handle_t ring_fd, const hbn_vnode_image_group_t *img_group);
+hobot_status hbn_frame_ring_get_drop_cnt(hbn_frame_ring_handle_t ring_fd, uint64_t *drop_cnt);
 
 hobot_status hbn_vflow_create(hbn_vflow_handle_t *vflow_fd);
 void hbn_vflow_destroy(hbn_vflow_handle_t vflow_fd);
@@ -388,6 +484,16 @@ hobot_status hbn_vflow_bind_vnode(hbn_vflow_handle_t vflow_fd, hbn_vnode_handle_
 				  hbn_vnode_handle_t dst_vnode_fd, uint32_t in_chn);
 hobot_status hbn_vflow_unbind_vnode(hbn_vflow_handle_t vflow_fd, hbn_vnode_handle_t src_vnode_fd, uint32_t out_chn,
 				    hbn_vnode_handle_t dst_vnode_fd, uint32_t in_chn);
+// Live bind/unbind of one M2M edge (BIND_M2M_OUTPUT -> BIND_M2M_INPUT) while the vflow is running.
+// Only the edge is paused: frames queued to dst are processed, frames held by dst are waited for
+// until millisecondTimeout (HBN_STATUS_DRAIN_TIMEOUT), other binds keep running. OTF edges return HBN_STATUS_NOT_SUPPORT.
+hobot_status hbn_vflow_bind_vnode_live(hbn_vflow_handle_t vflow_fd, hbn_vnode_handle_t src_vnode_fd, uint32_t out_chn,
+				       hbn_vnode_handle_t dst_vnode_fd, uint32_t in_chn);
+hobot_status hbn_vflow_unbind_vnode_live(hbn_vflow_handle_t vflow_fd, hbn_vnode_handle_t src_vnode_fd, uint32_t out_chn,
+					 hbn_vnode_handle_t dst_vnode_fd, uint32_t in_chn, uint32_t millisecondTimeout);
+hobot_status hbn_vflow_rebind_vnode(hbn_vflow_handle_t vflow_fd, hbn_vnode_handle_t src_vnode_fd, uint32_t out_chn,
+				    hbn_vnode_handle_t old_dst_vnode_fd, uint32_t old_in_chn, hbn_vnode_handle_t new_dst_vnode_fd,
+				    uint32_t new_in_chn, uint32_t millisecondTimeout); // src switches at a frame boundary, no frame lost
 hobot_status hbn_vflow_start(hbn_vflow_handle_t vflow_fd);
 hobot_status hbn_vflow_stop(hbn_vflow_handle_t vflow_fd);
 hobot_status hbn_vflow_pause(hbn_vflow_handle_t vflow_fd);
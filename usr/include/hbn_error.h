@@ -72,6 +72,10 @@ extern "C" {
 #define HBN_STATUS_RGN_UNEXIST (58)
 #define HBN_STATUS_RGN_INVALID_OPERATION (59)
 #define HBN_STATUS_RGN_OPEN_FILE_FAIL (60)
+#define HBN_STATUS_BACKEND_MISMATCH (61) // hbn backend changed after use, or not matching the hb_mem backend
+#define HBN_STATUS_FRAME_NOT_READY (62)
+#define HBN_STATUS_RING_ORDER_ERROR (63) // hbn_frame_ring_release out of acquire order
+#define HBN_STATUS_DRAIN_TIMEOUT (64)
 
 #define HBN_STATUS_ERR_UNKNOW (128)
 
@@ -0,0 +1,63 @@
+/***************************************************************************
+ *                      COPYRIGHT NOTICE
+ *             Copyright(C) 2024, D-Robotics Co., Ltd.
+ *                     All rights reserved.
+ ***************************************************************************/
+
+#ifndef J6_HBN_SW_CFG_H_
+#define J6_HBN_SW_CFG_H_
+
+#include "hbn_api.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Software vnode backend, enabled by hbn_set_backend(HBN_BACKEND_SW).
+ * HB_VIN, HB_VSE, HB_GDC, HB_N2D and HB_CODEC are emulated on CPU and keep
+ * the same attr structures and hbn_vnode_xxx/hbn_vflow_xxx calls as the
+ * hardware nodes. Output frames are hb_mem_graphic_buf_t allocated by the
+ * HB_MEM_BACKEND_MEMFD memory backend. Other vnode types return
+ * HBN_STATUS_NOT_SUPPORT from hbn_vnode_open.
+ *
+ * - HB_VIN: source selected by hbn_sw_vin_attr_t.src_type only, cim_attr.tpg_input.tpg_en
+ *           is ignored. Without hbn_sw_vin_set_source it is HBN_SW_SRC_TPG.
+ * - HB_VSE: crop and bilinear scale per vse_ochn_attr_t.
+ * - HB_GDC: scale to gdc_ochn_attr_t geometry, the gdc bin is not interpreted.
+ * - HB_N2D: scale/overlay/stitch/csc per n2d_config_t.
+ * - HB_CODEC: passes the input through as the output stream.
+ */
+
+#define HBN_SW_PATH_MAX 256u
+
+typedef enum hbn_sw_src_type_e {
+	HBN_SW_SRC_TPG, // color bar test pattern, frame id stamped in the first line
+	HBN_SW_SRC_FILE, // raw frames read back to back from a file
+	HBN_SW_SRC_INVALID,
+} hbn_sw_src_type_e;
+
+typedef struct hbn_sw_vin_attr_s {
+	hbn_sw_src_type_e src_type;
+	char file_path[HBN_SW_PATH_MAX]; // used by HBN_SW_SRC_FILE
+	uint32_t width;
+	uint32_t height;
+	uint32_t stride; // 0 means the same as width
+	int32_t format; // mem_pixel_format_t, MEM_PIX_FMT_NV12 or MEM_PIX_FMT_RAW8~RAW16
+	uint32_t fps; // 0 means free run, frames are produced as fast as they are released
+	uint32_t loop; // rewind to the first frame at EOF
+} hbn_sw_vin_attr_t;
+
+typedef struct hbn_sw_node_attr_s {
+	uint32_t proc_time_us; // extra emulated hardware time per frame, 0 means CPU time only
+	uint32_t worker_num; // CPU worker threads of the node, 0 means 1
+} hbn_sw_node_attr_t;
+
+hobot_status hbn_sw_vin_set_source(hbn_vnode_handle_t vnode_fd, const hbn_sw_vin_attr_t *attr);
+hobot_status hbn_sw_vnode_set_attr(hbn_vnode_handle_t vnode_fd, const hbn_sw_node_attr_t *attr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // J6_HBN_SW_CFG_H_
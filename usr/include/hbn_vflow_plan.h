@@ -0,0 +1,88 @@
+/***************************************************************************
+ *                      COPYRIGHT NOTICE
+ *             Copyright(C) 2024, D-Robotics Co., Ltd.
+ *                     All rights reserved.
+ ***************************************************************************/
+
+#ifndef J6_HBN_VFLOW_PLAN_H_
+#define J6_HBN_VFLOW_PLAN_H_
+
+#include "hbn_api.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Vflow graph compiler with static buffer planning.
+ * The pipeline description lists nodes, binds, fps and the latency budget of
+ * each consumer. For each output channel the planner takes the longest time a
+ * buffer is held: the producer process time, plus the slowest consumer of the
+ * channel within its latency budget. The depth is then
+ * ceil(fps * hold_time) + 1, which covers the buffer being written. Pym
+ * output_buf_num/fb_buf_num, gdc/codec buffer counts and ochn buffers_num are
+ * set from these depths. The result is written as a cfg file for
+ * hbn_vflow_create_cfg, together with a memory report.
+ *
+ * hbn_vflow_plan_json takes the same description in json. Each node names its
+ * entry in a base vflow cfg file, which is parsed by the node parsers
+ * (vse_node_parser_config etc.) as hbn_vflow_create_cfg does. orig_buf_num and
+ * buf_size come from that entry, an "ochn_size" array in the node overrides the
+ * sizes. A node without a base entry is a consumer outside the vflow.
+ */
+
+#define HBN_PLAN_NODE_MAX 64u
+#define HBN_PLAN_OCHN_MAX 8u // output channels of one node
+#define HBN_PLAN_BIND_MAX (HBN_PLAN_NODE_MAX * HBN_PIPELINE_BIND_MAX)
+#define HBN_PLAN_NAME_MAX 32u
+
+typedef struct hbn_plan_node_s {
+	char name[HBN_PLAN_NAME_MAX]; // unique node name, used in the report
+	hb_vnode_type vnode_type;
+	uint32_t hw_id;
+	int32_t ctx_id;
+	void *attr; // same attr as hbn_vnode_set_attr, could be NULL for a consumer outside the vflow
+	uint32_t fps; // input fps, 0 means taken from the upstream bind
+	uint32_t proc_time_us; // worst process time per frame
+	uint32_t ochn_num;
+	uint32_t ochn_size[HBN_PLAN_OCHN_MAX]; // bytes of one output buffer, 0 means taken from the ochn attr
+} hbn_plan_node_t;
+
+typedef struct hbn_plan_bind_s {
+	uint32_t src_node; // index in nodes
+	uint32_t out_chn;
+	uint32_t dst_node; // index in nodes
+	uint32_t in_chn;
+	uint32_t latency_budget_us; // longest time dst holds a buffer, 0 means dst proc_time_us
+} hbn_plan_bind_t;
+
+typedef struct hbn_plan_chn_report_s {
+	uint32_t node; // index in nodes
+	char name[HBN_PLAN_NAME_MAX]; // node name
+	uint32_t ochn_id;
+	uint32_t hold_time_us; // planned longest buffer hold time
+	uint32_t buf_num; // planned depth
+	uint32_t orig_buf_num; // depth in the attr before planning
+	uint64_t buf_size;
+} hbn_plan_chn_report_t;
+
+typedef struct hbn_plan_report_s {
+	hbn_plan_chn_report_t *chns; // in, array supplied by the caller
+	uint32_t chn_cap; // in, size of chns, at most HBN_PLAN_NODE_MAX * HBN_PLAN_OCHN_MAX is used
+	uint32_t chn_num; // out, HBN_STATUS_NOMEM if more than chn_cap
+	uint64_t total_size; // bytes of the planned buffers
+	uint64_t orig_total_size; // bytes of the buffers before planning
+} hbn_plan_report_t;
+
+hobot_status hbn_vflow_plan(const hbn_plan_node_t *nodes, uint32_t node_num, const hbn_plan_bind_t *binds,
+			    uint32_t bind_num, const char *cfg_file,
+			    hbn_plan_report_t *report); // bind_num <= HBN_PLAN_BIND_MAX, cfg_file could be NULL
+hobot_status hbn_vflow_plan_json(const char *graph_file, const char *base_cfg_file, const char *cfg_file,
+				 hbn_plan_report_t *report); // graph_file holds nodes and binds in json
+hobot_status hbn_vflow_plan_dump(const hbn_plan_report_t *report, char *buf, uint32_t size); // text memory report, one line per channel
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // J6_HBN_VFLOW_PLAN_H_
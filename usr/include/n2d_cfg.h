@@ -40,6 +40,7 @@ typedef struct n2d_config {
 	uint32_t overlay_x;
 	uint32_t overlay_y;
 	n2d_command_t command;
+	uint8_t async_mode; //submit by n2d_commit_async, the frame is done on its fence so the next frame submits at once
 } n2d_config_t;
 
 int32_t n2d_node_parser_config(const void *root, n2d_config_t *cfg);
@@ -112,6 +112,38 @@ typedef struct {
  */
 typedef void (*fc_done_cb)(uint32_t id, int32_t err);
 
+/**
+ * struct bpu_roi_result - per-ROI result of a batched resizer task
+ * @err: process status of the ROI
+ * @fc_index: index of the packed fc which processed the ROI
+ * @offset: result offset of the ROI in the model output memory
+ */
+typedef struct {
+	int32_t err;
+	uint32_t fc_index;
+	uint64_t offset;
+} bpu_roi_result_t;
+
+/**
+ * typedef fc_batch_done_cb - callcack for batched resizer task done.
+ * @id: the id which hb_bpu_core_set_fc_with_rsz_batch return
+ * @err: error status, <0 if any ROI failed
+ * @results: per-ROI result array in boxes order
+ * @roi_num: ROI number
+ * @userdata: user data pointer
+ *
+ * Called once when all packed fcs of the task process done.
+ * results is only valid in the callback.
+ *
+ * NOTE: the callback will affect the whole process,
+ * so need return as soon as possible.
+ */
+typedef void (*fc_batch_done_cb)(uint32_t id, int32_t err,
+		const bpu_roi_result_t *results, uint32_t roi_num,
+		void *userdata);
+
+struct hb_mem_graphic_buf_t;
+
 /**
  * (Legacy)cnn_core_num() - refer to hb_bpu_core_num
  */
@@ -274,6 +306,36 @@ int32_t hb_bpu_core_set_fc_with_rsz(void *fc,
 		fc_done_cb done_cb, roi_box_t *boxes,
 		uint32_t boxes_num);
 
+/**
+ * hb_bpu_core_set_fc_with_rsz_batch() - Set ROIs of one frame to
+ * 										 BPU Core with the fewest
+ * 										 packed functioncalls
+ * @fc: functioncall pointer of the resizer model which from hbrt tool
+ * @num: functioncall number
+ * @core_mask: bpu core index bit mask
+ * @frame: the source image, NV12 or Y only graphic buffer
+ * @boxes: roi box pointers, the origin image info is filled
+ * 		   from frame
+ * @boxes_num: roi box number
+ * @out_stride: output memory size of one ROI
+ * @done_cb: callback function which whill be call once
+ * 			 when all ROIs process done(could be null)
+ * @userdata: user data pointer passed to done_cb
+ *
+ * The ROIs are packed into as many ROIs per functioncall as the
+ * model batch and hb_bpu_core_fc_avl_cap of the cores allow,
+ * so 50+ ROIs need only a few submissions and completions.
+ *
+ * Return:
+ * * >=0                       - id which can be waited by
+ * 								 hb_bpu_core_check_fc_done
+ * * <0                        - error code
+ */
+int32_t hb_bpu_core_set_fc_with_rsz_batch(void *fc, uint32_t num,
+		uint32_t core_mask, const struct hb_mem_graphic_buf_t *frame,
+		roi_box_t *boxes, uint32_t boxes_num, uint64_t out_stride,
+		fc_batch_done_cb done_cb, void *userdata);
+
 /**
  * hb_bpu_core_fc_avl_id() - Get recommendation fc id
  * @core_index: bpu core index
@@ -473,6 +535,305 @@ int32_t hb_bpu_core_set_fc_with_rsz_prio(void *fc, uint32_t num,
 		uint32_t core_mask, fc_done_cb done_cb,
 		roi_box_t *boxes, uint32_t boxes_num,
 		uint32_t prio_level);
+
+#define BPU_SCHED_PRIO (0)
+#define BPU_SCHED_EDF (1)
+#define BPU_DEADLINE_MISS_RUN (0)
+#define BPU_DEADLINE_MISS_DEMOTE (1)
+#define BPU_DEADLINE_MISS_DROP (2)
+
+/**
+ * hb_bpu_set_sched_policy() - set the fc schedule policy of
+ * 							   all task groups
+ * @policy: BPU_SCHED_PRIO/BPU_SCHED_EDF
+ *
+ * BPU_SCHED_PRIO is the default policy, the group priority in
+ * group_id high 16bit and the group proportion decide the order.
+ * BPU_SCHED_EDF runs the fcs which set by
+ * hb_bpu_core_set_fc_deadline in earliest deadline first order
+ * across groups, the fcs without deadline run when no deadline
+ * fc is pending. Group proportion still caps each group.
+ *
+ * Return:
+ * * =0                       - success
+ * * <0                       - error code
+ */
+int32_t hb_bpu_set_sched_policy(uint32_t policy);
+
+/**
+ * hb_bpu_core_set_fc_deadline() - Set BPU Task(functioncall)
+ * 						  		   to process by BPU Core with
+ * 						  		   an absolute deadline
+ * @fc: functioncall pointer which from hbrt tool
+ * @num: functioncall number
+ * @core_mask: bpu core index bit mask
+ * @done_cb: callback function which whill be call
+ * 			 when task process done(could be null)
+ * @group_id: the group id which configure before
+ * @deadline_us: absolute deadline in CLOCK_MONOTONIC us
+ * @miss_policy: BPU_DEADLINE_MISS_RUN/DEMOTE/DROP
+ *
+ * The miss_policy applies when the deadline passes before the
+ * fc starts: RUN keeps it in deadline order, DEMOTE moves it
+ * behind the fcs without deadline, DROP removes it and reports
+ * -ETIME as the done error.
+ * Each miss is counted in the group deadline statistics.
+ *
+ * Return:
+ * * >=0                       - success
+ * * <0                        - error code
+ */
+int32_t hb_bpu_core_set_fc_deadline(void *fc, uint32_t num,
+		uint32_t core_mask, fc_done_cb done_cb,
+		uint32_t group_id, uint64_t deadline_us,
+		uint32_t miss_policy);
+
+/**
+ * hb_bpu_get_group_deadline_stat() - get the deadline statistics
+ * 									  of a task group
+ * @group_id: group id for fc task bind
+ * @miss_cnt: fc number which started or done after the deadline
+ * @drop_cnt: fc number dropped by BPU_DEADLINE_MISS_DROP
+ *
+ * Return:
+ * * =0                       - success
+ * * <0                       - error code
+ */
+int32_t hb_bpu_get_group_deadline_stat(uint32_t group_id,
+		uint64_t *miss_cnt, uint64_t *drop_cnt);
+////////////////////////////////////////////////////////////////
+
+//////////////////////////Dispatcher API////////////////////////
+#define BPU_LATENCY_BUCKET_NUM (24)
+
+/**
+ * struct bpu_model_latency - fc latency histogram of one model
+ * @model_id: the model id used in hb_bpu_dispatch_set_fc
+ * @count: done fc number
+ * @bucket: bucket[i] counts latency in [2^i, 2^(i+1)) us,
+ * 			bucket[0] also counts latency below 1us
+ * @p50_us: median latency
+ * @p99_us: 99th percentile latency
+ * @max_us: max latency
+ *
+ * latency is from hb_bpu_dispatch_set_fc to fc process done,
+ * so it includes the queueing time.
+ */
+typedef struct {
+	uint32_t model_id;
+	uint64_t count;
+	uint64_t bucket[BPU_LATENCY_BUCKET_NUM];
+	uint64_t p50_us;
+	uint64_t p99_us;
+	uint64_t max_us;
+} bpu_model_latency_t;
+
+/**
+ * hb_bpu_dispatch_init() - Init the load-aware fc dispatcher
+ * @core_mask: bpu core index bit mask which the dispatcher can use
+ * @steal_en: allow an idle core to take the queued fcs of
+ * 			  other cores
+ *
+ * Cores in core_mask must be opened by hb_bpu_core_open before.
+ *
+ * Return:
+ * * =0                       - success
+ * * <0                       - error code
+ */
+int32_t hb_bpu_dispatch_init(uint32_t core_mask, uint32_t steal_en);
+/**
+ * hb_bpu_dispatch_deinit() - Deinit the fc dispatcher
+ *
+ * Wait the queued fcs to be process done and release the
+ * dispatcher resource.
+ */
+void hb_bpu_dispatch_deinit(void);
+
+/**
+ * hb_bpu_dispatch_set_fc() - Set BPU Task(functioncall) to the
+ * 							  least loaded BPU Core
+ * @fc: functioncall pointer which from hbrt tool
+ * @num: functioncall number
+ * @core_type: the PE type the fc needs(CORE_TYPE_*),
+ * 			   CORE_TYPE_ANY for any core
+ * @model_id: user defined model id for latency statistics
+ * @prio_level: the priority level
+ * @done_cb: callback function which whill be call
+ * 			 when task process done(could be null)
+ *
+ * The core is chosen by the smallest
+ * hb_bpu_core_estimate_loading(core, prio_level) in the cores
+ * which match core_type and hb_bpu_core_fc_avl_cap >= num.
+ * If no core has enough capacity, the fc is queued on the
+ * least loaded core and set when capacity is available, or
+ * taken by another idle core when steal_en.
+ *
+ * Return:
+ * * >=0                       - fc id
+ * * <0                        - error code
+ */
+int32_t hb_bpu_dispatch_set_fc(void *fc, uint32_t num,
+		uint32_t core_type, uint32_t model_id,
+		uint32_t prio_level, fc_done_cb done_cb);
+
+/**
+ * hb_bpu_dispatch_wait_fc_done() - Wait for the specified fc task
+ * 									set by dispatcher to be process done
+ * @id: the fc id which hb_bpu_dispatch_set_fc return
+ * @timeout: wait timeout(ms)
+ *
+ * NOTE: the API can't be used when done_cb not NULL when
+ * 		 hb_bpu_dispatch_set_fc
+ *
+ * Return:
+ * * >=0                      - the core index which process the fc
+ * * <0                       - error code
+ */
+int32_t hb_bpu_dispatch_wait_fc_done(uint32_t id, int32_t timeout);
+
+/**
+ * hb_bpu_dispatch_get_latency() - Get the latency histogram of
+ * 								   a model
+ * @model_id: the model id used in hb_bpu_dispatch_set_fc
+ * @latency: latency histogram pointer
+ *
+ * Return:
+ * * =0                       - success
+ * * <0                       - error code
+ */
+int32_t hb_bpu_dispatch_get_latency(uint32_t model_id,
+		bpu_model_latency_t *latency);
+/**
+ * hb_bpu_dispatch_reset_latency() - Clear the latency histogram
+ * 									 of a model
+ * @model_id: the model id used in hb_bpu_dispatch_set_fc
+ *
+ * Return:
+ * * =0                       - success
+ * * <0                       - error code
+ */
+int32_t hb_bpu_dispatch_reset_latency(uint32_t model_id);
+////////////////////////////////////////////////////////////////
+
+//////////////////////////Trace API/////////////////////////////
+#define BPU_TRACE_DEPTH_DEFAULT (1024)
+#define BPU_TRACE_FRAME_TAG(pipeline_id, frame_id) \
+	(((uint64_t)(pipeline_id) << 32) | (uint32_t)(frame_id))
+
+/**
+ * struct bpu_trace_record - one fc record of the bpu core trace ring
+ * @submit_ns: time the fc is set to bpu(CLOCK_MONOTONIC ns)
+ * @start_ns: time the bpu core starts the fc
+ * @end_ns: time the fc process done
+ * @frame_tag: tag set by hb_bpu_trace_set_next_tag, 0 if not set
+ * @fc_id: fc id
+ * @core_index: bpu core index
+ * @prio_level: the priority level
+ * @group_id: the group id
+ *
+ * queueing time is start_ns - submit_ns, execution time is
+ * end_ns - start_ns.
+ */
+typedef struct {
+	uint64_t submit_ns;
+	uint64_t start_ns;
+	uint64_t end_ns;
+	uint64_t frame_tag;
+	uint32_t fc_id;
+	uint32_t core_index;
+	uint32_t prio_level;
+	uint32_t group_id;
+} bpu_trace_record_t;
+
+/**
+ * hb_bpu_trace_enable() - Enable the fc trace ring of bpu cores
+ * @core_mask: bpu core index bit mask
+ * @depth: record number of each core ring, 0 means
+ * 		   BPU_TRACE_DEPTH_DEFAULT
+ *
+ * The ring is shared with the driver and records are written
+ * without lock, the oldest records are overwritten when full.
+ *
+ * Return:
+ * * =0                       - success
+ * * <0                       - error code
+ */
+int32_t hb_bpu_trace_enable(uint32_t core_mask, uint32_t depth);
+/**
+ * hb_bpu_trace_disable() - Disable the fc trace ring of bpu cores
+ * @core_mask: bpu core index bit mask
+ */
+void hb_bpu_trace_disable(uint32_t core_mask);
+
+/**
+ * hb_bpu_trace_set_next_tag() - Set the frame tag of the next fc
+ * 								 submission of the calling thread
+ * @frame_tag: frame tag, BPU_TRACE_FRAME_TAG(pipeline_id,
+ * 			   hbn_frame_info_t.frame_id) is recommended
+ *
+ * The tag is per thread and taken by the next set_fc call
+ * (hb_bpu_core_set_fc*, hb_bpu_dispatch_set_fc) of the thread,
+ * so every fc of that call is recorded with the tag whatever
+ * core runs it. The tag is cleared after the call.
+ *
+ * Return:
+ * * =0                       - success
+ * * <0                       - error code
+ */
+int32_t hb_bpu_trace_set_next_tag(uint64_t frame_tag);
+
+/**
+ * hb_bpu_trace_read() - Read and consume records of a bpu core
+ * 						 trace ring
+ * @core_index: bpu core index
+ * @records: record array pointer
+ * @num: record array size
+ * @lost: records overwritten before read(could be null)
+ *
+ * Return:
+ * * >=0                      - record number read
+ * * <0                       - error code
+ */
+int32_t hb_bpu_trace_read(uint32_t core_index,
+		bpu_trace_record_t *records, uint32_t num, uint64_t *lost);
+
+#define BPU_TRACE_NAME_LEN (32)
+
+/**
+ * struct bpu_trace_frame_event - one frame slice of a non bpu
+ * 								  node for the trace export
+ * @name: track name, e.g. "isp0", "pym0"
+ * @frame_tag: the same tag as the fcs of the frame
+ * @start_ns: slice start(CLOCK_MONOTONIC ns), e.g.
+ * 			  hbn_frame_info_t.tv of the frame
+ * @end_ns: slice end, e.g. the time hbn_vnode_getframe returns
+ */
+typedef struct {
+	char name[BPU_TRACE_NAME_LEN];
+	uint64_t frame_tag;
+	uint64_t start_ns;
+	uint64_t end_ns;
+} bpu_trace_frame_event_t;
+
+/**
+ * hb_bpu_trace_export() - Export the trace records to a Chrome
+ * 						   trace/Perfetto JSON file
+ * @file: output file path
+ * @core_mask: bpu core index bit mask
+ * @events: vnode frame events(could be null)
+ * @event_num: vnode frame event number
+ *
+ * Each bpu core is a track with a queue slice and a run slice
+ * per fc, each event name is a track with a slice per frame.
+ * frame_tag is written as the flow id, so a frame is linked
+ * from the vnode slices to the fcs which use the same tag.
+ *
+ * Return:
+ * * >=0                      - record number exported
+ * * <0                       - error code
+ */
+int32_t hb_bpu_trace_export(const char *file, uint32_t core_mask,
+		const bpu_trace_frame_event_t *events, uint32_t event_num);
 ////////////////////////////////////////////////////////////////
 
 //////////////////////////Memory API////////////////////////////
@@ -787,6 +1148,134 @@ int32_t hb_bpu_get_cur_level(uint32_t core_index);
  */
 int64_t hb_bpu_core_estimate_loading(uint32_t core_index, uint32_t prio_level);
 
+#define BPU_GOV_FIXED (0)
+#define BPU_GOV_ONDEMAND (1)
+#define BPU_GOV_DEADLINE (2)
+#define BPU_GOV_USER (3)
+
+/**
+ * struct bpu_gov_sample - one governor input sample of a bpu core
+ * @loading_us: hb_bpu_core_estimate_loading of all prio levels
+ * @slack_us: min time left to the pending fc deadlines set by
+ * 			  hb_bpu_core_set_fc_deadline, INT64_MAX if none
+ * @busy_us: bpu core busy time in the last period
+ * @period_us: sample period
+ * @cur_level: working frequency level
+ * @total_level: hb_bpu_get_total_level
+ */
+typedef struct {
+	int64_t loading_us;
+	int64_t slack_us;
+	uint64_t busy_us;
+	uint64_t period_us;
+	int32_t cur_level;
+	int32_t total_level;
+} bpu_gov_sample_t;
+
+/**
+ * struct bpu_gov_ops - bpu frequency governor callbacks
+ * @select_level: return the frequency level for the sample,
+ * 				  the level uses the hb_bpu_set_frq_level rule
+ * @userdata: user private data for callbacks
+ */
+typedef struct {
+	int32_t (*select_level)(const bpu_gov_sample_t *sample,
+			void *userdata);
+	void *userdata;
+} bpu_gov_ops_t;
+
+/**
+ * struct bpu_gov_attr - bpu frequency governor attribute
+ * @type: BPU_GOV_FIXED/ONDEMAND/DEADLINE/USER
+ * @period_us: sample period, 0 means 10000us
+ * @fixed_level: working level of BPU_GOV_FIXED
+ * @up_threshold: busy percent to raise level of BPU_GOV_ONDEMAND,
+ * 				  [0,100], 0 means 80
+ * @down_threshold: busy percent to lower level of
+ * 					BPU_GOV_ONDEMAND, [0,100], 0 means 30,
+ * 					must be less than up_threshold
+ * @idle_off_us: power off the core after idle this time,
+ * 				 0 means keep power on
+ * @ops: governor callbacks of BPU_GOV_USER
+ *
+ * While fc is pending the policy of type chooses the level:
+ * BPU_GOV_FIXED keeps fixed_level, BPU_GOV_ONDEMAND steps the
+ * level by busy percent, BPU_GOV_DEADLINE picks the lowest level
+ * whose scaled loading_us still fits in slack_us and
+ * BPU_GOV_USER takes ops.select_level.
+ * Once the queue drains all governors race to idle: the core
+ * drops to the lowest level, and powers off after idle_off_us
+ * if it is set.
+ */
+typedef struct {
+	uint32_t type;
+	uint32_t period_us;
+	int32_t fixed_level;
+	uint32_t up_threshold;
+	uint32_t down_threshold;
+	uint32_t idle_off_us;
+	bpu_gov_ops_t ops;
+} bpu_gov_attr_t;
+
+/**
+ * hb_bpu_gov_start() - Start the frequency governor of bpu cores
+ * @core_mask: bpu core index bit mask
+ * @attr: governor attribute
+ *
+ * The governor replaces the app calls of hb_bpu_set_frq_level
+ * and hb_bpu_set_power on the cores until hb_bpu_gov_stop.
+ *
+ * Return:
+ * * =0                       - success
+ * * <0                       - error code
+ *
+ * -EINVAL is returned for BPU_GOV_ONDEMAND if a threshold is
+ * over 100, or down_threshold is not less than up_threshold
+ * after the 0 defaults are applied.
+ */
+int32_t hb_bpu_gov_start(uint32_t core_mask, const bpu_gov_attr_t *attr);
+/**
+ * hb_bpu_gov_stop() - Stop the frequency governor of bpu cores
+ * @core_mask: bpu core index bit mask
+ *
+ * The cores keep the working level when stopped.
+ */
+void hb_bpu_gov_stop(uint32_t core_mask);
+
+/**
+ * hb_bpu_gov_get_sample() - Get the governor input sample of
+ * 							 a bpu core now
+ * @core_index: bpu core index
+ * @sample: sample output, busy_us and period_us cover the time
+ * 			since the former call
+ *
+ * Works with or without a running governor, so samples can be
+ * logged on target and replayed by hb_bpu_gov_simulate.
+ *
+ * Return:
+ * * =0                       - success
+ * * <0                       - error code
+ */
+int32_t hb_bpu_gov_get_sample(uint32_t core_index, bpu_gov_sample_t *sample);
+
+/**
+ * hb_bpu_gov_simulate() - Run a governor on recorded samples
+ * @attr: governor attribute
+ * @samples: sample array, cur_level is taken from the former
+ * 			 decision after the first one
+ * @num: sample number
+ * @levels: output level array of num
+ *
+ * No bpu access, so governors can be tested and compared on
+ * host with samples logged by hb_bpu_gov_get_sample.
+ *
+ * Return:
+ * * =0                       - success
+ * * <0                       - error code
+ */
+int32_t hb_bpu_gov_simulate(const bpu_gov_attr_t *attr,
+		const bpu_gov_sample_t *samples, uint32_t num, int32_t *levels);
+
 #ifdef __cplusplus
 }
 #endif
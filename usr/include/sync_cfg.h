@@ -0,0 +1,50 @@
+/***************************************************************************
+ *                      COPYRIGHT NOTICE
+ *             Copyright(C) 2024, D-Robotics Co., Ltd.
+ *                     All rights reserved.
+ ***************************************************************************/
+
+#ifndef J6_VIO_SYNC_H_
+#define J6_VIO_SYNC_H_
+
+#include "hbn_api.h"
+
+/*
+ * HB_SYNC gathers frames of several pipelines by capture time.
+ * Each input channel is bound from an M2M output (or fed by hbn_vnode_sendframe), ochn 0 outputs one
+ * hbn_vnode_image_group_t per time window: graph_group[i] is the frame of ichn i, bit_map the ichns
+ * present, metadata points to sync_group_meta_t. The buffers are references to the source buffers and
+ * are counted: with SYNC_POLICY_DUP one source buffer can be in several groups, and
+ * hbn_vnode_releaseframe_group returns a source buffer to its vnode only when the last group holding it
+ * is released.
+ * The input number is bounded by HB_MEM_MAXIMUM_GRAPH_BUF, the graphic buffer number of a group.
+ */
+
+#define SYNC_IN_MAX HB_MEM_MAXIMUM_GRAPH_BUF
+
+typedef enum sync_policy_e {
+	SYNC_POLICY_DROP, // a window with a missing input is dropped
+	SYNC_POLICY_PARTIAL, // a window with a missing input is output, bit_map clears the input
+	SYNC_POLICY_DUP, // a missing input is filled with its last frame, dup_map sets the input
+	SYNC_POLICY_MAX
+} sync_policy_e;
+
+typedef struct sync_attr_s {
+	uint32_t input_num; // <= SYNC_IN_MAX
+	uint32_t tolerance_us; // max trig_tv distance of the frames in one window
+	uint32_t wait_ms; // max wait of the first frame of a window for the others
+	sync_policy_e policy;
+	uint32_t master_ichn; // window time is the trig_tv of this input
+	uint32_t queue_depth; // frames kept per input for matching, 0 means 2
+} sync_attr_t;
+
+typedef struct sync_group_meta_s {
+	hbn_frame_info_t info[SYNC_IN_MAX]; // frame info of each input
+	uint32_t dup_map; // inputs filled by SYNC_POLICY_DUP
+	int64_t skew_us; // max trig_tv distance in the window
+	uint64_t drop_cnt[SYNC_IN_MAX]; // frames of each input matched to no window
+} sync_group_meta_t;
+
+int32_t sync_node_parser_config(const void *root, sync_attr_t *cfg);
+
+#endif //J6_VIO_SYNC_H_
@@ -56,6 +56,10 @@ typedef struct vse_ochn_attr_ex_s {
 	common_rect_t roi;
 	uint32_t target_w;
 	uint32_t target_h;
+	uint32_t bp_en; // backpressure decimation, skip scaling while the consumer queue is over bp_high_wm
+	uint32_t bp_high_wm; // queued frames to start skipping
+	uint32_t bp_low_wm; // queued frames to restore dst_fps
+	uint32_t bp_min_fps; // lowest output fps while skipping, 0 means skip every frame over the watermark
 } vse_ochn_attr_ex_t;
 
 int32_t vse_node_parser_config(const void *root, vse_cfg_t *vse_attr);